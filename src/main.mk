@@ -47,6 +47,7 @@ SOURCES      := AS_global.C \
                 utility/kmers-writer-stream.C \
                 utility/kmers-statistics.C \
                 utility/kmers-exact.C \
+                utility/kmers-mapped.C \
                 \
                 utility/bits.C \
                 \
@@ -54,6 +55,7 @@ SOURCES      := AS_global.C \
                 utility/md5.C \
                 utility/mt19937ar.C \
                 utility/objectStore.C \
+                utility/phaseTrace.C \
                 utility/speedCounter.C \
                 utility/sweatShop.C \
                 \
@@ -213,5 +215,10 @@ SUBMAKEFILES := stores/dumpBlob.mk \
 ifeq ($(BUILDTESTS), 1)
 SUBMAKEFILES += utility/bitsTest.mk \
                 utility/filesTest.mk \
-                utility/stddevTest.mk
+                utility/kmersTest.mk \
+                utility/kmerLookupTest.mk \
+                utility/loserTreeTest.mk \
+                utility/sequenceTest.mk \
+                utility/stddevTest.mk \
+                stores/sqCacheTest.mk
 endif